@@ -16,9 +16,9 @@ AudioPluginAudioProcessorEditor::AudioPluginAudioProcessorEditor(AudioPluginAudi
     peakFreqSliderAttachment(audioProcessor.apvts, "Peak Frequency", peakFreqSlider),
     peakGainSliderAttachment(audioProcessor.apvts, "Peak Gain", peakGainSlider),
     peakQualitySliderAttachment(audioProcessor.apvts, "Peak Quality", peakQualitySlider),
-    lowCutFreqSliderAttachment(audioProcessor.apvts, "LowCutOff Frequency", lowCutSlopeSlider),
+    lowCutFreqSliderAttachment(audioProcessor.apvts, "LowCutOff Frequency", lowCutFreqSlider),
     highCutFreqSliderAttachment(audioProcessor.apvts, "HighCutOff Frequency", highCutFreqSlider),
-    lowCutSlopeSliderAttachment(audioProcessor.apvts, "LowCut Slope", lowCutFreqSlider),
+    lowCutSlopeSliderAttachment(audioProcessor.apvts, "LowCut Slope", lowCutSlopeSlider),
     highCutSlopeSliderAttachment(audioProcessor.apvts, "HighCut Slope", highCutSlopeSlider)
 
 {    
@@ -29,6 +29,12 @@ AudioPluginAudioProcessorEditor::AudioPluginAudioProcessorEditor(AudioPluginAudi
     {
         addAndMakeVisible(comp);        
     }
+
+    //the attachments move the sliders for host automation too, so this also catches parameter changes
+    for (auto* slider : { &peakFreqSlider, &peakGainSlider, &peakQualitySlider, &lowCutFreqSlider, &highCutFreqSlider, &lowCutSlopeSlider, &highCutSlopeSlider })
+    {
+        slider->onValueChange = [this] { repaint(); };
+    }
     setSize (600, 400);
 }
 
@@ -51,6 +57,8 @@ void AudioPluginAudioProcessorEditor::paint (juce::Graphics& g)
 
     auto w = responseArea.getWidth();
 
+    updateChain();
+
     auto& lowcut = monoChain.get<ChainPositions::Lowcut>();
     auto& peak = monoChain.get<ChainPositions::Peak>();
     auto& highcut = monoChain.get<ChainPositions::HighCut>();
@@ -87,16 +95,16 @@ void AudioPluginAudioProcessorEditor::paint (juce::Graphics& g)
             mag *= lowcut.get<3>().coefficients->getMagnitudeForFrequency(freq, sampleRate);
 
         if (!highcut.isBypassed<0>())
-            mag *= lowcut.get<0>().coefficients->getMagnitudeForFrequency(freq, sampleRate);
+            mag *= highcut.get<0>().coefficients->getMagnitudeForFrequency(freq, sampleRate);
 
         if (!highcut.isBypassed<1>())
-            mag *= lowcut.get<1>().coefficients->getMagnitudeForFrequency(freq, sampleRate);
+            mag *= highcut.get<1>().coefficients->getMagnitudeForFrequency(freq, sampleRate);
 
         if (!highcut.isBypassed<2>())
-            mag *= lowcut.get<2>().coefficients->getMagnitudeForFrequency(freq, sampleRate);
+            mag *= highcut.get<2>().coefficients->getMagnitudeForFrequency(freq, sampleRate);
 
         if (!highcut.isBypassed<3>())
-            mag *= lowcut.get<3>().coefficients->getMagnitudeForFrequency(freq, sampleRate);
+            mag *= highcut.get<3>().coefficients->getMagnitudeForFrequency(freq, sampleRate);
 
         mags[i] = Decibels::gainToDecibels(mag);
     }
@@ -167,6 +175,26 @@ void AudioPluginAudioProcessorEditor::resized()
 
 }
 
+void AudioPluginAudioProcessorEditor::updateChain()
+{
+    auto sampleRate = audioProcessor.getSampleRate();
+
+    //nothing to design against until the host has prepared the processor
+    if (sampleRate <= 0)
+        return;
+
+    auto chainSettings = getChainSettings(audioProcessor.apvts);
+
+    auto peakCoefficients = makePeakFilter(chainSettings, sampleRate);
+    updateCoefficients(monoChain.get<ChainPositions::Peak>().coefficients, peakCoefficients);
+
+    auto lowCutCoefficients = makeLowCutFilter(chainSettings, sampleRate);
+    updateCutFilter(monoChain.get<ChainPositions::Lowcut>(), lowCutCoefficients, chainSettings.lowCutSlope);
+
+    auto highCutCoefficients = makeHighCutFilter(chainSettings, sampleRate);
+    updateCutFilter(monoChain.get<ChainPositions::HighCut>(), highCutCoefficients, chainSettings.highCutSlope);
+}
+
 std::vector<juce::Component*> AudioPluginAudioProcessorEditor::getComps()
 {
     return
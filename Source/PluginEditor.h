@@ -42,6 +42,8 @@ private:
 
     std::vector<juce::Component*> getComps();
 
+    //mirrors the processor's current settings so the response curve matches what is heard
     MonoChain monoChain;
+    void updateChain();
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AudioPluginAudioProcessorEditor)
 };
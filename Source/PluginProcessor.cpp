@@ -234,20 +234,35 @@ ChainSettings getChainSettings(juce::AudioProcessorValueTreeState& apvts) {
 
 void AudioPluginAudioProcessor::updatePeakFilter(const ChainSettings& chainSettings)
 {
-    auto peakCoefficents = juce::dsp::IIR::Coefficients<float>::makePeakFilter(getSampleRate(), chainSettings.peakFreq, chainSettings.peakQuality, juce::Decibels::decibelsToGain(chainSettings.peakGainInDecibels));
+    auto peakCoefficents = makePeakFilter(chainSettings, getSampleRate());
 
     updateCoefficients(leftChain.get<ChainPositions::Peak>().coefficients, peakCoefficents);
     updateCoefficients(rightChain.get<ChainPositions::Peak>().coefficients, peakCoefficents);
 }
 
-void AudioPluginAudioProcessor::updateCoefficients(FilterCoefficients& old, const FilterCoefficients& replacements)
+void updateCoefficients(FilterCoefficients& old, const FilterCoefficients& replacements)
 {
     *old = *replacements;
 }
 
+FilterCoefficients makePeakFilter(const ChainSettings& chainSettings, double sampleRate)
+{
+    return juce::dsp::IIR::Coefficients<float>::makePeakFilter(sampleRate, chainSettings.peakFreq, chainSettings.peakQuality, juce::Decibels::decibelsToGain(chainSettings.peakGainInDecibels));
+}
+
+CutFilterCoefficients makeLowCutFilter(const ChainSettings& chainSettings, double sampleRate)
+{
+    return juce::dsp::FilterDesign<float>::designIIRHighpassHighOrderButterworthMethod(chainSettings.lowCutFreq, sampleRate, 2 * (chainSettings.lowCutSlope + 1));
+}
+
+CutFilterCoefficients makeHighCutFilter(const ChainSettings& chainSettings, double sampleRate)
+{
+    return juce::dsp::FilterDesign<float>::designIIRLowpassHighOrderButterworthMethod(chainSettings.highCutFreq, sampleRate, 2 * (chainSettings.highCutSlope + 1));
+}
+
 void AudioPluginAudioProcessor::updateLowCutFilters(const ChainSettings& chainSettings)
 {
-    auto lowcutCoefficients = juce::dsp::FilterDesign<float>::designIIRHighpassHighOrderButterworthMethod(chainSettings.lowCutFreq, getSampleRate(), 2 * (chainSettings.lowCutSlope + 1));
+    auto lowcutCoefficients = makeLowCutFilter(chainSettings, getSampleRate());
     auto& leftLowCut = leftChain.get<ChainPositions::Lowcut>();
     updateCutFilter(leftLowCut, lowcutCoefficients, chainSettings.lowCutSlope);
 
@@ -258,7 +273,7 @@ void AudioPluginAudioProcessor::updateLowCutFilters(const ChainSettings& chainSe
 
 void AudioPluginAudioProcessor::updateHighCutFilters(const ChainSettings& chainSettings)
 {
-    auto highcutCoefficients = juce::dsp::FilterDesign<float>::designIIRHighpassHighOrderButterworthMethod(chainSettings.highCutFreq, getSampleRate(), 2 * (chainSettings.highCutSlope + 1));
+    auto highcutCoefficients = makeHighCutFilter(chainSettings, getSampleRate());
 
     auto& leftHighCut = leftChain.get<ChainPositions::HighCut>();
     updateCutFilter(leftHighCut, highcutCoefficients, chainSettings.highCutSlope);
@@ -40,6 +40,51 @@ enum ChainPositions
     Peak,
     HighCut
 };
+
+//the editor builds its own MonoChain for the response curve, so the coefficient helpers live outside the processor
+using FilterCoefficients = Filter::CoefficientsPtr; //infer by referencing the auto in PluginProcessor.cpp
+//using FilterCoefficients = juce::dsp::IIR::Coefficients<float>::Ptr
+
+//one entry per second order section, as returned by the FilterDesign butterworth methods
+using CutFilterCoefficients = juce::ReferenceCountedArray<juce::dsp::IIR::Coefficients<float>>;
+
+void updateCoefficients(FilterCoefficients& old, const FilterCoefficients& replacements);
+
+FilterCoefficients makePeakFilter(const ChainSettings& chainSettings, double sampleRate);
+
+//each slope step adds another second order section, 12 dB/Oct -> order 2 ... 48 dB/Oct -> order 8
+CutFilterCoefficients makeLowCutFilter(const ChainSettings& chainSettings, double sampleRate);
+CutFilterCoefficients makeHighCutFilter(const ChainSettings& chainSettings, double sampleRate);
+
+template<int Index, typename ChainType, typename CoefficientType>
+void updateCutStage(ChainType& chain, const CoefficientType& coefficients)
+{
+    updateCoefficients(chain.template get<Index>().coefficients, coefficients[Index]);
+    chain.template setBypassed<Index>(false);
+}
+
+template<typename ChainType, typename CoefficientType>
+void updateCutFilter(ChainType& chain, const CoefficientType& coefficients, const Slope& slope)
+{
+    chain.template setBypassed<0>(true);
+    chain.template setBypassed<1>(true);
+    chain.template setBypassed<2>(true);
+    chain.template setBypassed<3>(true);
+
+    //no break so the subsequent cases will be executed
+    switch (slope)
+    {
+    case Slope_48:
+        updateCutStage<3>(chain, coefficients);
+    case Slope_36:
+        updateCutStage<2>(chain, coefficients);
+    case Slope_24:
+        updateCutStage<1>(chain, coefficients);
+    case Slope_12:
+        updateCutStage<0>(chain, coefficients);
+    }
+}
+
 //==============================================================================
 /**
 */
@@ -91,40 +136,6 @@ private:
     MonoChain leftChain, rightChain;
 
     void updatePeakFilter(const ChainSettings& chainSettings);
-    
-    using FilterCoefficients = Filter::CoefficientsPtr; //infer by referencing the auto in PluginProcessor.cpp
-    //using FilterCoefficients = juce::dsp::IIR::Coefficients<float>::Ptr
-
-    static void updateCoefficients(FilterCoefficients& old, const FilterCoefficients& replacements);
-
-    template<int Index, typename ChainType, typename CoefficientType>
-    void update(ChainType& chain, const CoefficientType& coefficients)
-    {
-        updateCoefficients(chain.template get<Index>().coefficients, coefficients[Index]);
-        chain.template setBypassed<Index>(false);
-    }
-
-    template<typename ChainType, typename CoefficientType>
-    void updateCutFilter(ChainType& chain, const CoefficientType& coefficients, const Slope& lowCutSlope)
-    {
-        chain.template setBypassed<0>(true);
-        chain.template setBypassed<1>(true);
-        chain.template setBypassed<2>(true);
-        chain.template setBypassed<3>(true);
-
-        //no break so the subsequent cases will be executed
-        switch (lowCutSlope)
-        {
-        case Slope_48:
-            update<3>(chain, coefficients);
-        case Slope_36:
-            update<2>(chain, coefficients);
-        case Slope_24:
-            update<1>(chain, coefficients);
-        case Slope_12:
-            update<0>(chain, coefficients);            
-        }
-    }
 
     void updateLowCutFilters(const ChainSettings& chainSettings);
     void updateHighCutFilters(const ChainSettings& chainSettings);
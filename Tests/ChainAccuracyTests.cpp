@@ -0,0 +1,533 @@
+/*
+  ==============================================================================
+
+    Renders impulses, sweeps and noise through AudioPluginAudioProcessor and
+    compares them against the double-precision chain in ReferenceChain.h.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "../Source/PluginProcessor.h"
+#include "ReferenceChain.h"
+
+namespace
+{
+
+const double sampleRates[] = { 44100.0, 48000.0, 88200.0, 96000.0, 176400.0, 192000.0 };
+
+const Slope slopes[] = { Slope_12, Slope_24, Slope_36, Slope_48 };
+
+struct Tolerance
+{
+    double response;            //|H - Href| / max(|Href|, responseFloor)
+    double magnitudeInDecibels;
+    double phaseInDegrees;      //magnitude and phase only where |Href| >= responseFloor
+    double samples;             //max |y - yref| / max |yref|
+};
+
+struct Scenario
+{
+    const char* name;
+    float lowCutFreq, highCutFreq, peakFreq, peakGainInDecibels, peakQuality;
+
+    //one per entry in sampleRates
+    Tolerance tolerances[6];
+};
+
+/*  The production chain designs its coefficients and runs its state in float.
+    Both errors grow roughly with (sampleRate / corner)^2, but the constant
+    varies a lot between sections, so a single law is either loose or wrong.
+    The bounds below are per scenario and sample rate instead: the worst case
+    over all sixteen slope pairs, measured on a float model of JUCE's
+    Coefficients and IIR::Filter code, then doubled.
+
+    A faster or better conditioned engine should tighten these, never loosen them.
+*/
+const Scenario scenarios[] =
+{
+    { "defaults", 20.0f, 20000.0f, 750.0f, 0.0f, 1.0f,
+      {
+        { 0.052, 0.33, 3, 0.0061 },            //44.1 kHz
+        { 0.047, 0.25, 2.3, 0.012 },           //48 kHz
+        { 0.48, 1.3, 26, 0.095 },              //88.2 kHz
+        { 0.47, 1.9, 24, 0.053 },              //96 kHz
+        { 0.72, 6.8, 36, 0.095 },              //176.4 kHz
+        { 0.96, 8.1, 45, 0.14 }                //192 kHz
+      } },
+    { "vocal band", 120.0f, 8000.0f, 1000.0f, 12.0f, 2.0f,
+      {
+        { 0.0081, 0.026, 0.2, 0.00016 },       //44.1 kHz
+        { 0.0094, 0.021, 0.2, 0.0002 },        //48 kHz
+        { 0.11, 0.12, 1.4, 0.0012 },           //88.2 kHz
+        { 0.11, 0.2, 1.8, 0.00084 },           //96 kHz
+        { 0.16, 0.61, 1.9, 0.0073 },           //176.4 kHz
+        { 0.36, 0.98, 6.5, 0.0087 }            //192 kHz
+      } },
+    { "narrow band cut", 1000.0f, 2000.0f, 1500.0f, -18.0f, 0.5f,
+      {
+        { 0.00019, 0.0012, 0.0023, 3.6e-05 },  //44.1 kHz
+        { 0.00026, 0.0016, 0.0022, 4.2e-05 },  //48 kHz
+        { 0.0016, 0.0023, 0.038, 0.0002 },     //88.2 kHz
+        { 0.0011, 0.0019, 0.017, 0.00024 },    //96 kHz
+        { 0.0037, 0.015, 0.088, 0.00082 },     //176.4 kHz
+        { 0.007, 0.015, 0.045, 0.0012 }        //192 kHz
+      } },
+    { "resonant bass boost", 20.0f, 20000.0f, 40.0f, 24.0f, 10.0f,
+      {
+        { 0.058, 0.32, 3.3, 0.06 },            //44.1 kHz
+        { 0.04, 0.34, 2.3, 0.049 },            //48 kHz
+        { 0.47, 1.3, 26, 0.091 },              //88.2 kHz
+        { 0.47, 2.3, 24, 0.13 },               //96 kHz
+        { 0.68, 6.7, 36, 0.13 },               //176.4 kHz
+        { 0.94, 7.5, 45, 0.46 }                //192 kHz
+      } }
+};
+
+//per block size patterns, repeated until the signal runs out; the first is the baseline the others must reproduce
+const std::vector<std::vector<int>> blockSplits =
+{
+    { 512 },
+    { 1 },
+    { 64 },
+    { 4096 },
+    { 13, 480, 1, 256, 77 }
+};
+
+//splits only move where JUCE snaps tiny filter state to zero, so they must agree almost exactly
+const double blockSplitTolerance = 1.0e-6;
+
+//responses are compared relative to the reference, floored at -30 dB so the
+//float noise floor deep in the stopband doesn't dominate
+const double responseFloor = 0.0316;
+
+//probe frequencies for the response comparison, log spaced like the editor's curve
+std::vector<double> getProbeFrequencies(double sampleRate)
+{
+    std::vector<double> frequencies;
+
+    for (int i = 0; i < 24; i++)
+    {
+        auto freq = juce::mapToLog10(double(i) / 23.0, 20.0, 20000.0);
+
+        if (freq < sampleRate * 0.49)
+            frequencies.push_back(freq);
+    }
+
+    return frequencies;
+}
+
+reference::Settings makeReferenceSettings(AudioPluginAudioProcessor& processor)
+{
+    auto chainSettings = getChainSettings(processor.apvts);
+
+    reference::Settings settings;
+    settings.lowCutFreq = chainSettings.lowCutFreq;
+    settings.highCutFreq = chainSettings.highCutFreq;
+    settings.peakFreq = chainSettings.peakFreq;
+    settings.peakGainInDecibels = chainSettings.peakGainInDecibels;
+    settings.peakQuality = chainSettings.peakQuality;
+
+    //taken from the choice text ("24 dB/Oct") rather than the Slope enum, so the
+    //slope to filter order mapping in the processor is checked, not mirrored
+    settings.lowCutDecibelsPerOctave = processor.apvts.getParameter("LowCut Slope")->getCurrentValueAsText().getIntValue();
+    settings.highCutDecibelsPerOctave = processor.apvts.getParameter("HighCut Slope")->getCurrentValueAsText().getIntValue();
+
+    return settings;
+}
+
+//ten time constants of the slowest pole in the chain, so the tail is down by about 87 dB
+int getImpulseLength(const reference::Settings& settings, double sampleRate)
+{
+    //a section's envelope decays with tau = 2Q / w0, and a peak's poles with tau = 2AQ / w0
+    auto getTimeConstant = [](double freq, double quality) { return quality / (reference::pi * freq); };
+
+    //the last section of a Butterworth cascade has the highest Q
+    auto getHighestQuality = [](int decibelsPerOctave)
+    {
+        auto order = reference::getOrderForSlope(decibelsPerOctave);
+        return 1.0 / (2.0 * std::cos((order - 1) * reference::pi / (2.0 * order)));
+    };
+
+    auto tau = juce::jmax(getTimeConstant(settings.lowCutFreq, getHighestQuality(settings.lowCutDecibelsPerOctave)),
+                          getTimeConstant(settings.highCutFreq, getHighestQuality(settings.highCutDecibelsPerOctave)));
+
+    if (settings.peakGainInDecibels != 0.0)
+        tau = juce::jmax(tau, getTimeConstant(settings.peakFreq, std::pow(10.0, settings.peakGainInDecibels / 40.0) * settings.peakQuality));
+
+    return int(std::ceil(10.0 * tau * sampleRate));
+}
+
+std::vector<float> makeImpulse(int numSamples)
+{
+    std::vector<float> impulse(size_t(numSamples), 0.0f);
+    impulse[0] = 1.0f;
+    return impulse;
+}
+
+std::vector<float> makeSweep(double sampleRate)
+{
+    //exponential sine sweep from 20 Hz to just below nyquist over a quarter second
+    auto numSamples = int(sampleRate / 4);
+    auto length = numSamples / sampleRate;
+    auto startFreq = 20.0;
+    auto rate = std::log(sampleRate * 0.45 / startFreq);
+
+    std::vector<float> sweep;
+
+    for (int i = 0; i < numSamples; i++)
+    {
+        auto t = i / sampleRate;
+        auto phase = 2.0 * reference::pi * startFreq * length / rate * (std::exp(t / length * rate) - 1.0);
+        sweep.push_back(float(0.5 * std::sin(phase)));
+    }
+
+    return sweep;
+}
+
+std::vector<float> makeNoise(int numSamples)
+{
+    juce::Random random(0x5eed);
+    std::vector<float> noise;
+
+    for (int i = 0; i < numSamples; i++)
+        noise.push_back(random.nextFloat() - 0.5f);
+
+    return noise;
+}
+
+std::vector<double> renderReference(const reference::Settings& settings, double sampleRate, const std::vector<float>& input)
+{
+    reference::Chain chain(settings, sampleRate);
+    return chain.process(std::vector<double>(input.begin(), input.end()));
+}
+
+//DFT of a rendered impulse response at a single frequency
+template<typename SampleType>
+std::complex<double> getResponseFromImpulse(const std::vector<SampleType>& impulseResponse, double freq, double sampleRate)
+{
+    auto omega = -2.0 * reference::pi * freq / sampleRate;
+    auto step = std::polar(1.0, omega);
+
+    std::complex<double> sum{ 0.0, 0.0 };
+    std::complex<double> rotation{ 1.0, 0.0 };
+
+    for (size_t i = 0; i < impulseResponse.size(); i++)
+    {
+        sum += double(impulseResponse[i]) * rotation;
+        rotation *= step;
+
+        //resynchronise so the running rotation doesn't drift
+        if ((i + 1) % 1024 == 0)
+            rotation = std::polar(1.0, omega * double(i + 1));
+    }
+
+    return sum;
+}
+
+double getSampleError(const std::vector<float>& actual, const std::vector<double>& expected)
+{
+    double maxError = 0.0, peak = 0.0;
+
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        maxError = juce::jmax(maxError, std::abs(actual[i] - expected[i]));
+        peak = juce::jmax(peak, std::abs(expected[i]));
+    }
+
+    return maxError / peak;
+}
+
+} // namespace
+
+//==============================================================================
+class ChainAccuracyTests : public juce::UnitTest
+{
+public:
+    ChainAccuracyTests() : juce::UnitTest("Chain accuracy against the double-precision reference", "AudioPlugin") {}
+
+    void runTest() override
+    {
+        beginTest("Reference matches the closed form Butterworth and peak responses");
+        testReference();
+
+        beginTest("Impulse response magnitude and phase, every slope pair");
+        forEachCase([this](const Scenario& scenario, size_t rateIndex, Slope lowCutSlope, Slope highCutSlope)
+        {
+            auto sampleRate = sampleRates[rateIndex];
+            auto& tolerance = scenario.tolerances[rateIndex];
+            auto context = describe(scenario, sampleRate, lowCutSlope, highCutSlope);
+
+            AudioPluginAudioProcessor processor;
+            applyScenario(processor, scenario, lowCutSlope, highCutSlope);
+
+            auto settings = makeReferenceSettings(processor);
+            auto input = makeImpulse(getImpulseLength(settings, sampleRate));
+            auto output = render(processor, sampleRate, input, blockSplits[0]);
+            auto expected = renderReference(settings, sampleRate, input);
+
+            //both sides are truncated to the same length, so truncation can't show up as error
+            expectResponseMatches(output, expected, sampleRate, tolerance, context);
+            expectSamplesMatch(output, expected, tolerance, context + ", impulse");
+        });
+
+        beginTest("Sweep and noise samples, every slope pair");
+        forEachCase([this](const Scenario& scenario, size_t rateIndex, Slope lowCutSlope, Slope highCutSlope)
+        {
+            auto sampleRate = sampleRates[rateIndex];
+            auto context = describe(scenario, sampleRate, lowCutSlope, highCutSlope);
+
+            for (auto& input : { makeSweep(sampleRate), makeNoise(32768) })
+            {
+                AudioPluginAudioProcessor processor;
+                applyScenario(processor, scenario, lowCutSlope, highCutSlope);
+
+                auto output = render(processor, sampleRate, input, blockSplits[0]);
+                auto settings = makeReferenceSettings(processor);
+
+                expectSamplesMatch(output, renderReference(settings, sampleRate, input), scenario.tolerances[rateIndex], context);
+            }
+        });
+
+        beginTest("Block size splits");
+        for (auto& scenario : scenarios)
+        {
+            for (size_t rateIndex = 0; rateIndex < std::size(sampleRates); rateIndex++)
+            {
+                auto sampleRate = sampleRates[rateIndex];
+
+                for (auto slope : slopes)
+                {
+                    auto input = makeNoise(8192);
+                    auto context = describe(scenario, sampleRate, slope, slope);
+
+                    std::vector<float> baseline;
+
+                    for (auto& split : blockSplits)
+                    {
+                        AudioPluginAudioProcessor processor;
+                        applyScenario(processor, scenario, slope, slope);
+
+                        auto output = render(processor, sampleRate, input, split);
+
+                        if (baseline.empty())
+                        {
+                            auto settings = makeReferenceSettings(processor);
+                            expectSamplesMatch(output, renderReference(settings, sampleRate, input), scenario.tolerances[rateIndex], context);
+                            baseline = output;
+                            continue;
+                        }
+
+                        juce::StringArray blockSizes;
+                        for (auto size : split)
+                            blockSizes.add(juce::String(size));
+
+                        double maxDifference = 0.0;
+                        for (size_t i = 0; i < baseline.size(); i++)
+                            maxDifference = juce::jmax(maxDifference, double(std::abs(output[i] - baseline[i])));
+
+                        expect(maxDifference <= blockSplitTolerance, "blocks " + blockSizes.joinIntoString(" ") + " differ from 512 by "
+                                                                     + juce::String(maxDifference) + " for " + context);
+                    }
+                }
+            }
+        }
+
+        beginTest("Cut filters attenuate on the correct side of the corner");
+        testCutDirection();
+    }
+
+private:
+    template<typename Callback>
+    void forEachCase(Callback&& callback)
+    {
+        for (auto& scenario : scenarios)
+            for (size_t rateIndex = 0; rateIndex < std::size(sampleRates); rateIndex++)
+                for (auto lowCutSlope : slopes)
+                    for (auto highCutSlope : slopes)
+                        callback(scenario, rateIndex, lowCutSlope, highCutSlope);
+    }
+
+    static juce::String describe(const Scenario& scenario, double sampleRate, Slope lowCutSlope, Slope highCutSlope)
+    {
+        juce::String str;
+        str << scenario.name << " @ " << sampleRate << " Hz, low cut " << (12 + lowCutSlope * 12)
+            << " dB/Oct, high cut " << (12 + highCutSlope * 12) << " dB/Oct";
+        return str;
+    }
+
+    void applySettings(AudioPluginAudioProcessor& processor, float lowCutFreq, float highCutFreq, float peakFreq,
+                       float peakGainInDecibels, float peakQuality, Slope lowCutSlope, Slope highCutSlope)
+    {
+        auto set = [&processor](const juce::String& parameterID, float value)
+        {
+            auto* parameter = processor.apvts.getParameter(parameterID);
+            parameter->setValueNotifyingHost(parameter->convertTo0to1(value));
+        };
+
+        set("LowCutOff Frequency", lowCutFreq);
+        set("HighCutOff Frequency", highCutFreq);
+        set("Peak Frequency", peakFreq);
+        set("Peak Gain", peakGainInDecibels);
+        set("Peak Quality", peakQuality);
+        set("LowCut Slope", float(lowCutSlope));
+        set("HighCut Slope", float(highCutSlope));
+
+        //make sure the values landed where the processor reads them
+        auto chainSettings = getChainSettings(processor.apvts);
+        expectWithinAbsoluteError(chainSettings.lowCutFreq, lowCutFreq, 0.5f);
+        expectWithinAbsoluteError(chainSettings.highCutFreq, highCutFreq, 0.5f);
+        expectWithinAbsoluteError(chainSettings.peakFreq, peakFreq, 0.5f);
+        expectWithinAbsoluteError(chainSettings.peakGainInDecibels, peakGainInDecibels, 0.01f);
+        expectWithinAbsoluteError(chainSettings.peakQuality, peakQuality, 0.01f);
+        expectEquals(int(chainSettings.lowCutSlope), int(lowCutSlope));
+        expectEquals(int(chainSettings.highCutSlope), int(highCutSlope));
+    }
+
+    void applyScenario(AudioPluginAudioProcessor& processor, const Scenario& scenario, Slope lowCutSlope, Slope highCutSlope)
+    {
+        applySettings(processor, scenario.lowCutFreq, scenario.highCutFreq, scenario.peakFreq,
+                      scenario.peakGainInDecibels, scenario.peakQuality, lowCutSlope, highCutSlope);
+    }
+
+    //drives processBlock the way a host would, one block at a time
+    std::vector<float> render(AudioPluginAudioProcessor& processor, double sampleRate, const std::vector<float>& input, const std::vector<int>& blockSizes)
+    {
+        auto maximumBlockSize = *std::max_element(blockSizes.begin(), blockSizes.end());
+        auto numSamples = int(input.size());
+
+        processor.setRateAndBufferSizeDetails(sampleRate, maximumBlockSize);
+        processor.prepareToPlay(sampleRate, maximumBlockSize);
+
+        juce::AudioBuffer<float> buffer(2, numSamples);
+        for (int channel = 0; channel < buffer.getNumChannels(); channel++)
+            buffer.copyFrom(channel, 0, input.data(), numSamples);
+
+        juce::MidiBuffer midiMessages;
+
+        for (size_t block = 0, start = 0; int(start) < numSamples; block++)
+        {
+            auto blockSize = juce::jmin(blockSizes[block % blockSizes.size()], numSamples - int(start));
+            juce::AudioBuffer<float> blockBuffer(buffer.getArrayOfWritePointers(), buffer.getNumChannels(), int(start), blockSize);
+
+            processor.processBlock(blockBuffer, midiMessages);
+            start += size_t(blockSize);
+        }
+
+        processor.releaseResources();
+
+        //both chains see the same input and settings, so they must agree exactly
+        auto* left = buffer.getReadPointer(0);
+        auto* right = buffer.getReadPointer(1);
+        expect(std::equal(left, left + numSamples, right), "left and right channels differ");
+
+        return std::vector<float>(left, left + numSamples);
+    }
+
+    void expectResponseMatches(const std::vector<float>& impulseResponse, const std::vector<double>& referenceImpulseResponse, double sampleRate,
+                               const Tolerance& tolerance, const juce::String& context)
+    {
+        for (auto freq : getProbeFrequencies(sampleRate))
+        {
+            auto actual = getResponseFromImpulse(impulseResponse, freq, sampleRate);
+            auto expected = getResponseFromImpulse(referenceImpulseResponse, freq, sampleRate);
+            auto where = context + ", " + juce::String(freq, 1) + " Hz";
+
+            auto error = std::abs(actual - expected) / juce::jmax(std::abs(expected), responseFloor);
+            expect(error <= tolerance.response, "response error " + juce::String(error) + " at " + where);
+
+            if (std::abs(expected) < responseFloor)
+                continue;
+
+            auto magnitudeError = std::abs(juce::Decibels::gainToDecibels(std::abs(actual) / std::abs(expected), -300.0));
+            expect(magnitudeError <= tolerance.magnitudeInDecibels, "magnitude error " + juce::String(magnitudeError) + " dB at " + where);
+
+            auto phaseError = juce::radiansToDegrees(std::abs(std::arg(actual / expected)));
+            expect(phaseError <= tolerance.phaseInDegrees, "phase error " + juce::String(phaseError) + " degrees at " + where);
+        }
+    }
+
+    void expectSamplesMatch(const std::vector<float>& actual, const std::vector<double>& expected, const Tolerance& tolerance, const juce::String& context)
+    {
+        auto error = getSampleError(actual, expected);
+        expect(error <= tolerance.samples, "sample error " + juce::String(error) + " for " + context);
+    }
+
+    void testReference()
+    {
+        for (auto sampleRate : sampleRates)
+        {
+            for (int order = 2; order <= 8; order += 2)
+            {
+                for (auto isHighPass : { false, true })
+                {
+                    for (auto cutoff : { 20.0, 1000.0, 15000.0 })
+                    {
+                        auto sections = reference::makeButterworth(isHighPass, sampleRate, cutoff, order);
+
+                        auto getMagnitude = [&sections, sampleRate](double freq)
+                        {
+                            std::complex<double> h{ 1.0, 0.0 };
+                            for (auto& section : sections)
+                                h *= section.getResponse(freq, sampleRate);
+                            return std::abs(h);
+                        };
+
+                        for (auto freq : getProbeFrequencies(sampleRate))
+                            expectWithinAbsoluteError(getMagnitude(freq), reference::getButterworthMagnitude(isHighPass, sampleRate, cutoff, order, freq), 1.0e-8);
+
+                        //every Butterworth order is 3 dB down at the corner
+                        expectWithinAbsoluteError(juce::Decibels::gainToDecibels(getMagnitude(cutoff)), -10.0 * std::log10(2.0), 1.0e-6);
+                    }
+                }
+            }
+
+            for (auto gainInDecibels : { -24.0, -6.0, 12.0, 24.0 })
+            {
+                for (auto quality : { 0.1, 1.0, 10.0 })
+                {
+                    auto peak = reference::makePeak(sampleRate, 1000.0, quality, gainInDecibels);
+                    expectWithinAbsoluteError(juce::Decibels::gainToDecibels(std::abs(peak.getResponse(1000.0, sampleRate))), gainInDecibels, 1.0e-9);
+                    expectWithinAbsoluteError(std::abs(peak.getResponse(0.0, sampleRate)), 1.0, 1.0e-9);
+                }
+            }
+        }
+    }
+
+    //independent of the reference: a low cut must remove lows and a high cut must remove highs
+    void testCutDirection()
+    {
+        for (auto sampleRate : sampleRates)
+        {
+            for (auto slope : slopes)
+            {
+                auto decibelsPerOctave = 12.0 + slope * 12.0;
+                auto measure = [this, sampleRate, slope](float lowCutFreq, float highCutFreq, double freq)
+                {
+                    AudioPluginAudioProcessor processor;
+                    applySettings(processor, lowCutFreq, highCutFreq, 750.0f, 0.0f, 1.0f, slope, slope);
+
+                    auto input = makeImpulse(getImpulseLength(makeReferenceSettings(processor), sampleRate));
+                    auto output = render(processor, sampleRate, input, blockSplits[0]);
+                    return juce::Decibels::gainToDecibels(std::abs(getResponseFromImpulse(output, freq, sampleRate)), -300.0);
+                };
+
+                juce::String context;
+                context << sampleRate << " Hz, " << decibelsPerOctave << " dB/Oct";
+
+                //an octave past the corner a Butterworth is down by at least its slope
+                auto highCutPass = measure(20.0f, 1000.0f, 125.0);
+                auto highCutStop = measure(20.0f, 1000.0f, 2000.0);
+                expect(highCutPass > -0.1, "high cut attenuated its passband by " + juce::String(-highCutPass) + " dB at " + context);
+                expect(highCutStop < -(decibelsPerOctave - 0.5), "high cut only reached " + juce::String(highCutStop) + " dB an octave above at " + context);
+
+                auto lowCutPass = measure(1000.0f, 20000.0f, 8000.0);
+                auto lowCutStop = measure(1000.0f, 20000.0f, 500.0);
+                expect(lowCutPass > -0.1, "low cut attenuated its passband by " + juce::String(-lowCutPass) + " dB at " + context);
+                expect(lowCutStop < -(decibelsPerOctave - 0.5), "low cut only reached " + juce::String(lowCutStop) + " dB an octave below at " + context);
+            }
+        }
+    }
+};
+
+static ChainAccuracyTests chainAccuracyTests;
@@ -0,0 +1,27 @@
+/*
+  ==============================================================================
+
+    Runs every juce::UnitTest in the AudioPlugin category and reports
+    failure through the exit code so ctest can pick it up.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+
+int main()
+{
+    //the processor's parameters and value tree need a message manager
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    juce::UnitTestRunner runner;
+    runner.setAssertOnFailure(false);
+    runner.runTestsInCategory("AudioPlugin");
+
+    int failures = 0;
+
+    for (int i = 0; i < runner.getNumResults(); i++)
+        failures += runner.getResult(i)->failures;
+
+    return failures > 0 ? 1 : 0;
+}
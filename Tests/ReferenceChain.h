@@ -0,0 +1,195 @@
+/*
+  ==============================================================================
+
+    Slow double-precision reference for the low-cut/peak/high-cut chain.
+
+    This deliberately has no JUCE dependency and shares no code with the
+    plugin, so it can act as ground truth for the production MonoChain.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <cmath>
+#include <complex>
+#include <vector>
+
+namespace reference
+{
+
+constexpr double pi = 3.14159265358979323846;
+
+//a single second order section, processed in direct form I
+struct Biquad
+{
+    double b0{ 1.0 }, b1{ 0.0 }, b2{ 0.0 }, a1{ 0.0 }, a2{ 0.0 };
+
+    double processSample(double x)
+    {
+        auto y = b0 * x + b1 * x1 + b2 * x2 - a1 * y1 - a2 * y2;
+
+        x2 = x1;
+        x1 = x;
+        y2 = y1;
+        y1 = y;
+
+        return y;
+    }
+
+    //evaluates H(z) on the unit circle
+    std::complex<double> getResponse(double freq, double sampleRate) const
+    {
+        auto z1 = std::polar(1.0, -2.0 * pi * freq / sampleRate);
+        auto z2 = z1 * z1;
+
+        return (b0 + b1 * z1 + b2 * z2) / (1.0 + a1 * z1 + a2 * z2);
+    }
+
+    void reset()
+    {
+        x1 = x2 = y1 = y2 = 0.0;
+    }
+
+private:
+    double x1{ 0.0 }, x2{ 0.0 }, y1{ 0.0 }, y2{ 0.0 };
+};
+
+//bilinear transform of 1 / (s^2 + s/Q + 1), prewarped so the corner lands on freq
+inline Biquad makeLowPass(double sampleRate, double freq, double q)
+{
+    auto k = std::tan(pi * freq / sampleRate);
+    auto norm = 1.0 / (1.0 + k / q + k * k);
+
+    Biquad bq;
+    bq.b0 = k * k * norm;
+    bq.b1 = 2.0 * bq.b0;
+    bq.b2 = bq.b0;
+    bq.a1 = 2.0 * (k * k - 1.0) * norm;
+    bq.a2 = (1.0 - k / q + k * k) * norm;
+    return bq;
+}
+
+//bilinear transform of s^2 / (s^2 + s/Q + 1)
+inline Biquad makeHighPass(double sampleRate, double freq, double q)
+{
+    auto k = std::tan(pi * freq / sampleRate);
+    auto norm = 1.0 / (1.0 + k / q + k * k);
+
+    Biquad bq;
+    bq.b0 = norm;
+    bq.b1 = -2.0 * norm;
+    bq.b2 = norm;
+    bq.a1 = 2.0 * (k * k - 1.0) * norm;
+    bq.a2 = (1.0 - k / q + k * k) * norm;
+    return bq;
+}
+
+//peaking EQ from the RBJ audio EQ cookbook
+inline Biquad makePeak(double sampleRate, double freq, double q, double gainInDecibels)
+{
+    auto a = std::pow(10.0, gainInDecibels / 40.0);
+    auto w0 = 2.0 * pi * freq / sampleRate;
+    auto alpha = std::sin(w0) / (2.0 * q);
+    auto a0 = 1.0 + alpha / a;
+
+    Biquad bq;
+    bq.b0 = (1.0 + alpha * a) / a0;
+    bq.b1 = -2.0 * std::cos(w0) / a0;
+    bq.b2 = (1.0 - alpha * a) / a0;
+    bq.a1 = bq.b1;
+    bq.a2 = (1.0 - alpha / a) / a0;
+    return bq;
+}
+
+//even order Butterworth as order/2 cascaded sections, one per conjugate pole pair
+inline std::vector<Biquad> makeButterworth(bool isHighPass, double sampleRate, double freq, int order)
+{
+    std::vector<Biquad> sections;
+
+    for (int k = 0; k < order / 2; k++)
+    {
+        auto q = 1.0 / (2.0 * std::cos((2.0 * k + 1.0) * pi / (2.0 * order)));
+        sections.push_back(isHighPass ? makeHighPass(sampleRate, freq, q) : makeLowPass(sampleRate, freq, q));
+    }
+
+    return sections;
+}
+
+//closed form |H| of the bilinear-transformed Butterworth, used to check makeButterworth itself
+inline double getButterworthMagnitude(bool isHighPass, double sampleRate, double cutoff, int order, double freq)
+{
+    auto ratio = std::tan(pi * freq / sampleRate) / std::tan(pi * cutoff / sampleRate);
+
+    if (isHighPass)
+        ratio = 1.0 / ratio;
+
+    return 1.0 / std::sqrt(1.0 + std::pow(ratio, 2.0 * order));
+}
+
+//slopes are expressed in dB/Oct, each order contributes 6 dB/Oct
+inline int getOrderForSlope(int decibelsPerOctave)
+{
+    return decibelsPerOctave / 6;
+}
+
+struct Settings
+{
+    double lowCutFreq{ 20.0 }, highCutFreq{ 20000.0 };
+    int lowCutDecibelsPerOctave{ 12 }, highCutDecibelsPerOctave{ 12 };
+    double peakFreq{ 750.0 }, peakGainInDecibels{ 0.0 }, peakQuality{ 1.0 };
+};
+
+//low cut -> peak -> high cut, the same topology as MonoChain
+class Chain
+{
+public:
+    Chain(const Settings& settings, double sampleRate)
+    {
+        sections = makeButterworth(true, sampleRate, settings.lowCutFreq, getOrderForSlope(settings.lowCutDecibelsPerOctave));
+        sections.push_back(makePeak(sampleRate, settings.peakFreq, settings.peakQuality, settings.peakGainInDecibels));
+
+        for (auto& section : makeButterworth(false, sampleRate, settings.highCutFreq, getOrderForSlope(settings.highCutDecibelsPerOctave)))
+            sections.push_back(section);
+    }
+
+    double processSample(double x)
+    {
+        for (auto& section : sections)
+            x = section.processSample(x);
+
+        return x;
+    }
+
+    std::vector<double> process(const std::vector<double>& input)
+    {
+        std::vector<double> output;
+        output.reserve(input.size());
+
+        for (auto x : input)
+            output.push_back(processSample(x));
+
+        return output;
+    }
+
+    std::complex<double> getResponse(double freq, double sampleRate) const
+    {
+        std::complex<double> h{ 1.0, 0.0 };
+
+        for (auto& section : sections)
+            h *= section.getResponse(freq, sampleRate);
+
+        return h;
+    }
+
+    void reset()
+    {
+        for (auto& section : sections)
+            section.reset();
+    }
+
+private:
+    std::vector<Biquad> sections;
+};
+
+} // namespace reference